@@ -0,0 +1,66 @@
+#ifndef COOLANTPROPERTIES_H
+#define COOLANTPROPERTIES_H
+
+#include "MooseTypes.h"
+
+#include <string>
+#include <vector>
+
+// Coolant properties tabulated on a rectilinear grid in pressure (Pa) and
+// temperature (K), evaluated for a whole batch of temperatures (such as every
+// axial layer of every channel) at once with bilinear interpolation. The table
+// is read from a CSV file with a header naming the columns 'pressure',
+// 'temperature', and any of 'density' (kg/m^3), 'viscosity' (Pa-s), and 'k'
+// (W/m-K). Rows must be ordered by pressure and then by temperature, and the
+// temperatures must be evenly spaced so that each lookup is a single division.
+//
+// Without a file, the table holds the density of water at 15 MPa from the
+// correlation previously used in the Nek transfer, from 400 K to 615 K.
+class CoolantProperties
+{
+public:
+  enum Property
+  {
+    DENSITY,
+    VISCOSITY,
+    CONDUCTIVITY,
+    NUM_PROPERTIES
+  };
+
+  explicit CoolantProperties(const std::string & file_name = "");
+
+  // evaluate a property at a single pressure for every temperature
+  void evaluate(Property property,
+                Real pressure,
+                const std::vector<Real> & temperatures,
+                std::vector<Real> & values) const;
+
+  // number densities of water molecules (atoms/barn-cm), as OpenMC expects
+  // them, at a single pressure for every temperature
+  void evaluateWaterNumberDensity(Real pressure,
+                                  const std::vector<Real> & temperatures,
+                                  std::vector<Real> & densities) const;
+
+  bool hasProperty(Property property) const { return !_data[property].empty(); }
+
+  Real minTemperature() const { return _T_min; }
+  Real maxTemperature() const { return _T_min + (_num_T - 1) * _dT; }
+
+protected:
+  void readFile(const std::string & file_name);
+
+  // set up the temperature grid and check the table sizes
+  void finalizeTable(const std::vector<Real> & temperatures, const std::string & source);
+
+  static const std::string & propertyName(Property property);
+
+  std::vector<Real> _pressures;
+  std::size_t _num_T;
+  Real _T_min;
+  Real _dT;
+
+  // each property at every (pressure, temperature), with temperature fastest
+  std::vector<Real> _data[NUM_PROPERTIES];
+};
+
+#endif /* COOLANTPROPERTIES_H */
@@ -0,0 +1,78 @@
+#ifndef FUNCTIONALEXPANSIONEVALUATOR_H
+#define FUNCTIONALEXPANSIONEVALUATOR_H
+
+#include "MooseTypes.h"
+
+#include <string>
+#include <vector>
+
+// Evaluates a functional expansion at a fixed set of points. The basis
+// functions are tabulated at every point when the evaluator is constructed
+// using recurrence relations, so that reconstructing the field for a new set
+// of coefficients (such as on every Picard iteration) is a single pass over
+// the table. Points are given in the normalized coordinates of the expansion:
+//
+//   legendre:           x = cosine of the scattering angle
+//   spatiallegendre:    x in [-1, 1] along the axis of the expansion
+//   sphericalharmonics: (x, y, z) = unit direction vector
+//   zernike:            (x, y) on the unit disc
+//   zernike-legendre:   (x, y) on the unit disc, z in [-1, 1] along the axis
+//
+// The orderings match the OpenMC filters and, for Zernike-Legendre, the
+// MOOSE CylindricalDuo series (axial index outermost).
+class FunctionalExpansionEvaluator
+{
+public:
+  // The normalizations offered by MOOSE for its functional expansions:
+  // orthonormal scales each function by the inverse of its norm squared, so
+  // that the expansion coefficients are simple projections of the field, and
+  // sqrt_mu scales by the square root of that factor.
+  enum Normalization
+  {
+    STANDARD,
+    SQRT_MU,
+    ORTHONORMAL
+  };
+
+  // expansion of one of the OpenMC expansion filter types
+  FunctionalExpansionEvaluator(const std::string & type,
+                               unsigned int order,
+                               const std::vector<Point> & points,
+                               Normalization normalization = STANDARD);
+
+  // Zernike expansion in the (x, y) plane times a Legendre expansion in z
+  FunctionalExpansionEvaluator(unsigned int legendre_order,
+                               unsigned int zernike_order,
+                               const std::vector<Point> & points,
+                               Normalization normalization = STANDARD);
+
+  std::size_t numFunctions() const { return _num_functions; }
+  std::size_t numPoints() const { return _num_points; }
+
+  // evaluate the expansion with the given coefficients at every point
+  void evaluate(const std::vector<Real> & coefficients, std::vector<Real> & values) const;
+
+  // Tabulate the basis functions at every point. Function k at point p is
+  // stored at table[k * n + p], where n is the number of points.
+  static void legendreBasis(unsigned int order,
+                            const std::vector<Real> & x,
+                            Normalization normalization,
+                            std::vector<Real> & table);
+  static void zernikeBasis(unsigned int order,
+                           const std::vector<Real> & x,
+                           const std::vector<Real> & y,
+                           Normalization normalization,
+                           std::vector<Real> & table);
+  static void sphericalHarmonicsBasis(unsigned int order,
+                                      const std::vector<Point> & directions,
+                                      std::vector<Real> & table);
+
+protected:
+  std::size_t _num_functions;
+  std::size_t _num_points;
+
+  // basis functions at every point, function-major
+  std::vector<Real> _basis;
+};
+
+#endif /* FUNCTIONALEXPANSIONEVALUATOR_H */
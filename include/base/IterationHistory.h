@@ -0,0 +1,81 @@
+#ifndef ITERATIONHISTORY_H
+#define ITERATIONHISTORY_H
+
+#include "MooseTypes.h"
+
+#include <condition_variable>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Streams the values transferred on each Picard iteration (k_eff, expansion
+// coefficients, fluid layer temperatures, ...) to a compact binary file, so
+// that the full history never needs to be kept in memory or reprinted to the
+// console. Records are appended to an in-memory buffer that is written by a
+// background thread once it fills up or is flushed, and only the most recent
+// values of each series are kept for convergence checks. Use scripts/read-history.py to
+// print the history as tables.
+//
+// The recent values are kept in storage owned by the caller, so that they can
+// be checkpointed and restored along with the rest of the coupled state. When
+// continuing a run, the existing file is cut back to the size it had when the
+// checkpoint was written (see bytesWritten()), so that the iterations repeated
+// after recovering are not recorded twice, and records are appended to it.
+//
+// The file starts with the 8 bytes "OKHIST1\n", followed by one record per
+// call to record() in native byte order:
+//
+//   uint32 name length, name, int32 iteration, uint32 number of values, doubles
+class IterationHistory
+{
+public:
+  // most recent values of each series, oldest first
+  typedef std::map<std::string, std::vector<std::vector<Real>>> RecentValues;
+
+  IterationHistory(const std::string & file_name,
+                   std::size_t history_length,
+                   RecentValues & recent,
+                   std::size_t append_offset = 0,
+                   std::size_t buffer_size = 1 << 16);
+  ~IterationHistory();
+
+  void record(const std::string & series, int iteration, const std::vector<Real> & values);
+
+  // the most recent values of a series, oldest first
+  const std::vector<std::vector<Real>> & recent(const std::string & series) const;
+
+  // write everything recorded so far and wait for it to reach the file
+  void flush();
+
+  // size of the file once everything handed to the writer has been written,
+  // which is the offset to continue from after flush()
+  std::size_t bytesWritten();
+
+protected:
+  // hand the filled buffer to the writer thread, waiting if it is still busy
+  void submit();
+
+  void writerLoop();
+
+  std::ofstream _file;
+  const std::size_t _history_length;
+  const std::size_t _buffer_size;
+
+  // buffer being filled by record(), and the one being written by the thread
+  std::vector<char> _buffer;
+  std::vector<char> _pending;
+  bool _has_pending;
+  bool _done;
+  std::size_t _bytes_written;
+
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::thread _writer;
+
+  RecentValues & _recent;
+};
+
+#endif /* ITERATIONHISTORY_H */
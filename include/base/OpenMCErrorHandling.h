@@ -16,4 +16,8 @@ void openmc_cell_get_id(int, const std::string &);
 void openmc_filter_get_type(int, const std::string &);
 void openmc_cell_filter_get_bins(int, const std::string &);
 void openmc_filter_get_order(int, const std::string &);
+void openmc_simulation_init(int);
+void openmc_next_batch(int);
+void openmc_source_bank(int);
+void openmc_simulation_finalize(int);
 }
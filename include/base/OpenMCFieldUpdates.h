@@ -0,0 +1,38 @@
+#ifndef OPENMCFIELDUPDATES_H
+#define OPENMCFIELDUPDATES_H
+
+#include "MooseTypes.h"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+// Setting the cell temperatures (K) and material densities (atom/b-cm) that
+// the transfers send to OpenMC. Every value is recorded by index in
+// 'recorded', so that the values can be checkpointed. When 'pending' is given,
+// the values are only held there to be applied later with
+// apply_cell_temperatures and apply_material_densities, as is done when OpenMC
+// runs concurrently on other ranks; otherwise they are set in OpenMC at once.
+
+void set_cell_temperature(int32_t cell_index,
+                          Real temperature,
+                          std::map<int32_t, Real> & recorded,
+                          std::map<int32_t, Real> * pending = nullptr);
+void set_material_density(int32_t material_index,
+                          Real density,
+                          std::map<int32_t, Real> & recorded,
+                          std::map<int32_t, Real> * pending = nullptr);
+
+void set_cell_temperatures(const std::vector<int32_t> & cell_indices,
+                           const std::vector<Real> & temperatures,
+                           std::map<int32_t, Real> & recorded,
+                           std::map<int32_t, Real> * pending = nullptr);
+void set_material_densities(const std::vector<int32_t> & material_indices,
+                            const std::vector<Real> & densities,
+                            std::map<int32_t, Real> & recorded,
+                            std::map<int32_t, Real> * pending = nullptr);
+
+void apply_cell_temperatures(const std::map<int32_t, Real> & temperatures);
+void apply_material_densities(const std::map<int32_t, Real> & densities);
+
+#endif /* OPENMCFIELDUPDATES_H */
@@ -0,0 +1,89 @@
+#ifndef OPENMCINDEXCACHE_H
+#define OPENMCINDEXCACHE_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Lazily-built lookups of OpenMC indices that are shared by all of the Okapi
+// transfers, so that each cell, material, and tally ID is resolved (and each
+// tally's filters are inspected) only a single time per simulation. The cache
+// clears itself if the number of OpenMC cells, materials, filters, or tallies
+// changes, since the indices may then no longer be valid.
+class OpenMCIndexCache
+{
+public:
+  // Layout of the results for a single cell in a tally with one cell filter
+  // and one functional expansion filter
+  struct TallyCellInfo
+  {
+    // position of the cell in the cell filter bins
+    int32_t stride;
+
+    // number of cells in the cell filter
+    int32_t num_cells_in_filter;
+
+    // position of the cell filter among the tally's two filters
+    int32_t cell_filter_index;
+
+    // type and order of the functional expansion filter
+    std::string expansion_type;
+    int32_t order;
+  };
+
+  OpenMCIndexCache();
+
+  int32_t cellIndex(int32_t cell_id, const std::string & desc);
+  int32_t materialIndex(int32_t material_id, const std::string & desc);
+  int32_t tallyIndex(int32_t tally_id, const std::string & desc);
+
+  // filter layout for the given cell in the given tally, both specified by ID
+  TallyCellInfo tallyCellInfo(int32_t tally_id, int32_t cell_id, const std::string & desc);
+
+  // indices and filter layouts of several cells in the same tally, such as one
+  // cell for every sub app of a batch transfer
+  void tallyCells(int32_t tally_id,
+                  const std::vector<int32_t> & cell_ids,
+                  const std::string & desc,
+                  std::vector<int32_t> & cell_indices,
+                  std::vector<TallyCellInfo> & info);
+
+  void invalidate();
+
+  // Number of times the cache has been cleared. Indices and layouts kept
+  // outside of the cache must be looked up again whenever this changes.
+  unsigned int generation();
+
+protected:
+  struct TallyFilterInfo
+  {
+    int32_t num_cells_in_filter;
+    int32_t cell_filter_index;
+    std::string expansion_type;
+    int32_t order;
+
+    // cell index to position in the cell filter bins
+    std::unordered_map<int32_t, int32_t> bin_of_cell;
+  };
+
+  // clear the cache if the OpenMC geometry or tallies have changed size
+  void checkValid();
+
+  const TallyFilterInfo & tallyFilterInfo(int32_t tally_index, const std::string & desc);
+
+  std::unordered_map<int32_t, int32_t> _cell_index;
+  std::unordered_map<int32_t, int32_t> _material_index;
+  std::unordered_map<int32_t, int32_t> _tally_index;
+  std::unordered_map<int32_t, TallyFilterInfo> _tally_filters;
+
+  unsigned int _generation;
+
+  // sizes of the OpenMC arrays when the cache was filled
+  int32_t _n_cells;
+  int32_t _n_materials;
+  int32_t _n_filters;
+  int32_t _n_tallies;
+};
+
+#endif /* OPENMCINDEXCACHE_H */
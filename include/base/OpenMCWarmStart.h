@@ -0,0 +1,34 @@
+#ifndef OPENMCWARMSTART_H
+#define OPENMCWARMSTART_H
+
+#include "MooseTypes.h"
+#include "openmc.h"
+
+#include <vector>
+
+// Runs OpenMC with the fission source seeded by the source bank converged in
+// the previous run on this rank, so that far fewer inactive batches are needed
+// after the first run.
+class OpenMCWarmStart
+{
+public:
+  OpenMCWarmStart(unsigned int warm_start_inactive);
+
+  // run OpenMC, returning the number of histories saved by warm starting
+  Real run();
+
+  // fission source from the end of the previous run on this rank, which may be
+  // set before the first run to warm start from a checkpointed source
+  std::vector<Bank> & source() { return _source; }
+
+protected:
+  const unsigned int _warm_start_inactive;
+
+  // number of inactive batches (and total batches) in the settings XML file
+  int32_t _cold_inactive;
+  int32_t _cold_batches;
+
+  std::vector<Bank> _source;
+};
+
+#endif /* OPENMCWARMSTART_H */
@@ -0,0 +1,64 @@
+#ifndef TALLYSLICE_H
+#define TALLYSLICE_H
+
+#include "MooseTypes.h"
+#include "OpenMCIndexCache.h"
+
+#include <vector>
+
+// Running sums used to judge the convergence of the expansion coefficients
+// transferred from one or more slices of a functional expansion tally
+struct TallySliceStatistics
+{
+  TallySliceStatistics();
+
+  // combine the sums from another slice with these sums
+  void merge(const TallySliceStatistics & other);
+
+  // standard deviation of the transferred (possibly relaxed) tally means
+  // relative to the tally means
+  Real relativeError() const;
+
+  // Root mean square difference between the tally means of the latest run
+  // and the coefficients they are transferred into, in standard deviations of
+  // those means. This is measured before relaxing, since the relaxed change
+  // shrinks with the relaxation weight whether or not the fields converge.
+  Real normalizedChange() const;
+
+  // sums of the squared tally means and squared standard deviations of the
+  // transferred (possibly relaxed) means
+  Real mean_sq;
+  Real variance;
+
+  // sums of the squared standard deviations of the latest run's means and of
+  // their squared difference from the previous coefficients
+  Real run_variance;
+  Real change_sq;
+};
+
+// Scatter one cell's slice of an OpenMC tally into a vector of expansion
+// coefficients. Coefficient i is read from filter bin 'offset + i * stride' of
+// the (value, sum, sum_sq) results, scaled by 'multiplier', and blended with the
+// existing coefficient using the relaxation weight 'alpha' (1 overwrites it).
+void scatter_tally_slice(const double * tally_results,
+                         std::size_t offset,
+                         std::size_t stride,
+                         int32_t realizations,
+                         Real multiplier,
+                         Real alpha,
+                         std::vector<Real> & coefficients,
+                         TallySliceStatistics & stats);
+
+// Scatter a cell's coefficients from a tally with one cell filter and one
+// functional expansion filter, laid out as described by 'info'. The slice is
+// contiguous if the cell filter comes first, and strided by the number of
+// cells in the filter otherwise.
+void scatter_cell_tally(const double * tally_results,
+                        const OpenMCIndexCache::TallyCellInfo & info,
+                        int32_t realizations,
+                        Real multiplier,
+                        Real alpha,
+                        std::vector<Real> & coefficients,
+                        TallySliceStatistics & stats);
+
+#endif /* TALLYSLICE_H */
@@ -2,6 +2,14 @@
 #define OPENMCEXECUTIONER_H
 
 #include "Transient.h"
+#include "OpenMCIndexCache.h"
+#include "CoolantProperties.h"
+#include "IterationHistory.h"
+#include "TallySlice.h"
+
+#include <memory>
+#include <set>
+
 class OpenMCExecutioner;
 
 template <>
@@ -13,5 +21,141 @@ public:
   OpenMCExecutioner(const InputParameters & parameters);
 
   virtual void init() override;
+  virtual bool keepGoing() override;
+  virtual void endStep(Real input_time = -1.0) override;
+
+  // get the OpenMCExecutioner driving an app, which owns the OpenMC state
+  // shared between all Okapi objects
+  static OpenMCExecutioner & get(MooseApp & app);
+
+  OpenMCIndexCache & indexCache() { return _index_cache; }
+
+  // coolant property tables shared by all of the transfers
+  const CoolantProperties & coolantProperties() const { return _coolant_properties; }
+
+  // whether OpenMC runs concurrently with the sub apps on its own ranks
+  bool concurrentCoupling() const { return _concurrent; }
+
+  // whether this rank participates in the OpenMC transport solve
+  bool runsOpenMC() const { return _runs_openmc; }
+
+  // Set a cell temperature or material density (in atom/b-cm) in OpenMC. In
+  // concurrent mode these are buffered and applied at the next synchronize().
+  void setCellTemperature(int32_t cell_index, Real temperature);
+  void setMaterialDensity(int32_t material_index, Real density);
+
+  // set the temperatures or densities of many cells or materials at once
+  void setCellTemperatures(const std::vector<int32_t> & cell_indices,
+                           const std::vector<Real> & temperatures);
+  void setMaterialDensities(const std::vector<int32_t> & material_indices,
+                            const std::vector<Real> & densities);
+
+  // Results of a tally from the most recent OpenMC run, with the same layout as
+  // openmc_tally_results. In concurrent mode these are the results copied at the
+  // last synchronize(), since OpenMC may already be running again.
+  void tallyResults(int32_t tally_index, double ** results, int shape[3], const std::string & desc);
+
+  // number of realizations in the most recent OpenMC run
+  int32_t realizations() const;
+
+  // In concurrent mode, apply the temperatures and densities buffered since the
+  // last call on the OpenMC ranks, and copy the results of the OpenMC run that
+  // just finished to every rank. Must be called on all ranks.
+  void synchronize();
+
+  // in concurrent mode, copy a value found on the OpenMC ranks to every rank
+  // so that it can be reported; must be called on all ranks
+  void broadcastFromOpenMC(Real & value);
+
+  // called by the timestepper after each OpenMC run with the number of
+  // histories that contributed to the tallies
+  void openmcRunFinished(Real histories);
+
+  // weight given to the newest OpenMC results when relaxing transferred
+  // quantities (1 when no relaxation is applied)
+  Real relaxationWeight() const { return _relaxation_weight; }
+
+  // k_eff from the most recent OpenMC run, relaxed if requested
+  Real keff();
+
+  // called by transfers with the statistics of the coefficients they transferred
+  void reportTallyConvergence(const TallySliceStatistics & stats);
+
+  // append the values of a series transferred on this Picard iteration to the
+  // history file, and get the most recent values of a series
+  void recordHistory(const std::string & series, const std::vector<Real> & values);
+  const std::vector<std::vector<Real>> & recentHistory(const std::string & series);
+
+protected:
+  // whether the coupled solution has met the requested tolerances
+  bool couplingConverged();
+
+  // in concurrent mode, gather the values set by transfers on every rank and
+  // apply them on the OpenMC ranks
+  void applyPendingValues();
+
+  // apply the cell temperatures and material densities from a checkpoint to
+  // the freshly initialized OpenMC
+  void restoreOpenMCState();
+
+  OpenMCIndexCache _index_cache;
+  const CoolantProperties _coolant_properties;
+
+  const bool _relax;
+  const Real & _coefficient_tol;
+  const Real & _relative_error_tol;
+
+  // total number of histories over all OpenMC runs, used for relaxation
+  Real & _total_histories;
+  Real & _relaxation_weight;
+
+  // relaxed k_eff, and whether it has been updated for the most recent run
+  Real & _keff;
+  bool _keff_current;
+
+  // largest relative tally error and coefficient change (in standard
+  // deviations) reported since the last convergence check
+  Real _max_relative_error;
+  Real _max_normalized_change;
+  unsigned int _num_reports;
+  unsigned int & _num_runs;
+
+  const bool & _concurrent;
+  const unsigned int & _openmc_procs;
+
+  // in concurrent mode, the communicator OpenMC is initialized with: the ranks
+  // running OpenMC, or the other ranks that only use its geometry and tallies
+  Parallel::Communicator _openmc_comm;
+  bool _runs_openmc;
+
+  // rank in the master communicator of the root OpenMC rank
+  processor_id_type _openmc_root;
+
+  // values set by transfers that have not been applied to OpenMC yet
+  std::map<int32_t, Real> _pending_temperatures;
+  std::map<int32_t, Real> _pending_densities;
+
+  // every value set by transfers on this rank, by cell or material index,
+  // which are checkpointed since OpenMC's own copies are not
+  std::map<int32_t, Real> & _cell_temperatures;
+  std::map<int32_t, Real> & _material_densities;
+
+  // results of the last OpenMC run that finished in concurrent mode, for the
+  // tallies that transfers have requested
+  std::set<int32_t> _requested_tallies;
+  std::map<int32_t, std::vector<double>> _tally_snapshot;
+  std::map<int32_t, std::vector<int>> _tally_shape;
+  std::vector<Real> _keff_snapshot;
+  int32_t _realizations_snapshot;
+
+  // history of the transferred values, opened when the first value is recorded
+  const FileName & _history_file;
+  const unsigned int & _history_length;
+  std::unique_ptr<IterationHistory> _history;
+  IterationHistory::RecentValues & _recent_history;
+
+  // size of this rank's history file at the end of the last step, which the
+  // file is cut back to when recovering
+  std::size_t & _history_offset;
 };
 #endif // OPENMCEXECUTIONER_H
@@ -2,8 +2,12 @@
 #define OPENMCTIMESTEPPER_H
 
 #include "TimeStepper.h"
+#include "OpenMCWarmStart.h"
+
+#include <thread>
 
 class OpenMCTimeStepper;
+class OpenMCExecutioner;
 
 template <>
 InputParameters validParams<OpenMCTimeStepper>();
@@ -12,6 +16,7 @@ class OpenMCTimeStepper : public TimeStepper
 {
 public:
   OpenMCTimeStepper(const InputParameters & parameters);
+  virtual ~OpenMCTimeStepper();
 
 protected:
   virtual Real computeInitialDT() override;
@@ -19,8 +24,47 @@ protected:
   virtual void step() override;
   virtual void postExecute() override;
 
+  // increase the number of particles per batch for the next OpenMC run
+  void growParticles();
+
+  // reset the tallies and perform a full OpenMC solve. This does not write
+  // to the console, since it runs in the background in concurrent mode.
+  void runOpenMC();
+
+  // set the particle count and fission source from a checkpoint, once OpenMC
+  // has been initialized from its input files
+  void restoreOpenMCState();
+
+  // report a finished OpenMC run to the executioner
+  void openmcRunFinished(OpenMCExecutioner & executioner);
+
 private:
   Real _dt;
+
+  const Real & _particle_growth_factor;
+  const int64_t _max_particles;
+
+  const bool & _warm_start;
+  OpenMCWarmStart _warm_starter;
+
+  // total number of histories saved by warm starting, and the number saved
+  // by the most recent run
+  Real & _histories_saved;
+  Real _histories_saved_this_run;
+
+  // Particles per batch and warm start fission source for the next run, as
+  // of the end of the last step. The source is copied, since in concurrent
+  // mode the next run replaces it while a checkpoint may be written.
+  int64_t & _restart_particles;
+  std::vector<Bank> & _restart_source;
+  bool _state_restored;
+
+  // In concurrent coupling mode, whether an OpenMC run has finished since this
+  // process started, and whether a run was started in the background on the
+  // last step (on every rank, whether or not it runs OpenMC)
+  bool _has_results;
+  bool _run_in_progress;
+  std::thread _openmc_thread;
 };
 
 #endif // OPENMCTIMESTEPPER_H
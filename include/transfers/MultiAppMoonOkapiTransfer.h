@@ -16,7 +16,7 @@ class MultiAppMoonOkapiTransfer : public MultiAppTransfer
 public:
   MultiAppMoonOkapiTransfer(const InputParameters & parameters);
   virtual void execute() override;
-  void printResults(std::vector<Real> & results);
+  void printResults(const std::vector<Real> & results);
 
 protected:
   std::vector<VariableName> _source_var_names;
@@ -29,9 +29,8 @@ protected:
 
   const Real & _T_inlet;
   const Real & _T_outlet;
+  const Real & _pressure;
   const bool & _store_results;
-
-  std::vector<std::vector<Real>> _fluid_layer_temps;
 };
 
 #endif /* MULTIAPPMOONOKAPITRANSFER_H */
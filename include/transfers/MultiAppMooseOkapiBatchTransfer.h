@@ -0,0 +1,39 @@
+#ifndef MULTIAPPMOOSEOKAPIBATCHTRANSFER_H
+#define MULTIAPPMOOSEOKAPIBATCHTRANSFER_H
+
+// MOOSE includes
+#include "MultiAppFXTransfer.h"
+#include "OpenMCIndexCache.h"
+
+class MultiAppMooseOkapiBatchTransfer;
+
+template <>
+InputParameters validParams<MultiAppMooseOkapiBatchTransfer>();
+
+class MultiAppMooseOkapiBatchTransfer : public MultiAppFXTransfer
+{
+public:
+  MultiAppMooseOkapiBatchTransfer(const InputParameters & parameters);
+  virtual void execute() override;
+  virtual void initialSetup() override;
+
+protected:
+  void runChecks();
+
+protected:
+  const std::vector<int32_t> & _cell;
+  int32_t _tally;
+  const bool & _dbg;
+  int32_t _tally_index;
+
+  // OpenMC cell index and layout of the cell in the tally, per sub app
+  std::vector<int32_t> _cell_index;
+  std::vector<OpenMCIndexCache::TallyCellInfo> _cell_info;
+
+  const Real _geometry_multiplier;
+
+  // generation of the shared index cache that the lookups were made in
+  unsigned int _checks_generation;
+};
+
+#endif /* MULTIAPPMOOSEOKAPIBATCHTRANSFER_H */
@@ -4,6 +4,9 @@
 // MOOSE includes
 #include "MultiAppFXTransfer.h"
 
+#include "FunctionalExpansionEvaluator.h"
+#include "OpenMCIndexCache.h"
+
 class MultiAppMooseOkapiTransfer;
 
 template <>
@@ -15,12 +18,14 @@ public:
   MultiAppMooseOkapiTransfer(const InputParameters & parameters);
   virtual void execute() override;
   virtual void initialSetup() override;
-  void printResults(std::vector<Real> & results);
+  void printResults(const std::vector<Real> & results);
 
 protected:
-  bool getOrderAndCheckExpansionType(const char * type, const int32_t & index, int32_t & order);
   void runChecks();
 
+  // set the temperature of every sub-cell from the expansion coefficients
+  void setSubcellTemperatures(const std::vector<Real> & coefficients);
+
 protected:
   int32_t _cell;
   int32_t _tally;
@@ -29,16 +34,24 @@ protected:
   int32_t _cell_index;
   int32_t _tally_index;
 
-  // vectors to hold values for all previous Picard iterations
-  std::vector<Real> _k_eff;
-  std::vector<std::vector<Real>> _fuel_temp_coeffs;
-  std::vector<std::vector<Real>> _fission_coeffs;
-
   const Real _geometry_multiplier;
-  bool _checks_done;
-  int32_t _num_cells_in_filter;
-  int32_t _stride_integer;
-  int32_t _cell_filter_index;
+
+  // generation of the shared index cache that the tally layout was found in
+  unsigned int _checks_generation;
+
+  // layout of the cell in the tally
+  OpenMCIndexCache::TallyCellInfo _cell_info;
+
+  // sub-cells of the OpenMC cell that receive the reconstructed temperature field
+  const std::vector<int32_t> & _subcells;
+  const std::vector<Point> & _subcell_points;
+  const std::vector<unsigned int> & _temperature_orders;
+  const FunctionalExpansionEvaluator::Normalization _temperature_normalization;
+  std::vector<int32_t> _subcell_index;
+  std::vector<Real> _subcell_temperatures;
+
+  // built on the first transfer from MOOSE, once the number of coefficients is known
+  std::unique_ptr<FunctionalExpansionEvaluator> _temperature_evaluator;
 };
 
 #endif /* MULTIAPPMOOSEOKAPITRANSFER_H */
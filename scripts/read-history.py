@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""Print the iteration history written by the OpenMCExecutioner as tables.
+
+Each series (such as 'to_bison/k_eff', or 'from_bison/0/fuel_temperature_coeffs'
+for the first sub app) is printed as one table, with a row for each Picard
+iteration. Several files can be given, such as the files written by each rank,
+and are merged.
+
+Usage:
+  read-history.py master_out_history.bin [more files] [--series NAME] [--csv]
+"""
+
+import argparse
+import struct
+import sys
+from collections import OrderedDict
+
+MAGIC = b'OKHIST1\n'
+
+
+def read_history(file_name, history):
+    with open(file_name, 'rb') as f:
+        data = f.read()
+
+    if data[:len(MAGIC)] != MAGIC:
+        sys.exit("'{}' is not an Okapi iteration history file".format(file_name))
+
+    pos = len(MAGIC)
+    while pos < len(data):
+        name_length, = struct.unpack_from('=I', data, pos)
+        pos += 4
+        name = data[pos:pos + name_length].decode()
+        pos += name_length
+        iteration, num_values = struct.unpack_from('=iI', data, pos)
+        pos += 8
+        values = struct.unpack_from('={}d'.format(num_values), data, pos)
+        pos += 8 * num_values
+
+        history.setdefault(name, []).append((iteration, values))
+
+
+def print_table(name, rows, csv):
+    if csv:
+        print(name)
+        for iteration, values in rows:
+            print(','.join([str(iteration)] + ['{:.6g}'.format(v) for v in values]))
+    else:
+        print('{}:'.format(name))
+        print('  {:>9}  values'.format('iteration'))
+        for iteration, values in rows:
+            print('  {:>9}  '.format(iteration) + ' '.join('{:12.6g}'.format(v) for v in values))
+    print()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('files', nargs='+', help='history files to read')
+    parser.add_argument('--series', action='append',
+                        help='only print these series (may be repeated)')
+    parser.add_argument('--csv', action='store_true', help='print comma-separated values')
+    args = parser.parse_args()
+
+    history = OrderedDict()
+    for file_name in args.files:
+        read_history(file_name, history)
+
+    for name, rows in history.items():
+        if args.series and name not in args.series:
+            continue
+        print_table(name, sorted(rows, key=lambda row: row[0]), args.csv)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,58 @@
+#ifndef MOCKNEK_H
+#define MOCKNEK_H
+
+// Stand-in for the Nek5000 common blocks and routines declared in
+// include/base/NekInterface.h, implemented in MockNek.C. The Fortran arrays
+// are fixed size, so the common blocks are declared with the largest
+// expansions and number of layers that Okapi supports rather than as the
+// flexible array members of NekInterface.h, which need neither Moose.h nor
+// ENABLE_NEK_COUPLING.
+
+#define MOCK_NEK_MAX_COEFFS 100
+#define MOCK_NEK_MAX_LAYERS 100000
+
+namespace Nek5000
+{
+extern "C" {
+
+extern struct ExpansionTcoef
+{
+  double coeff_tij[MOCK_NEK_MAX_COEFFS * MOCK_NEK_MAX_COEFFS];
+} expansion_tcoef_;
+
+extern struct ExpansionFcoef
+{
+  double coeff_fij[MOCK_NEK_MAX_COEFFS * MOCK_NEK_MAX_COEFFS];
+} expansion_fcoef_;
+
+extern struct ExpansionTdata
+{
+  int n_legendre;
+  int m_fourier;
+} expansion_tdata_;
+
+extern struct LayerData
+{
+  int n_layer;
+} layer_data_;
+
+extern struct FluidBins
+{
+  double fluid_temp_bins[MOCK_NEK_MAX_LAYERS];
+} fluid_bins_;
+
+void nek_expansion_();
+void flux_reconstruction_();
+void axially_binned_integration_();
+}
+}
+
+namespace MockNek
+{
+
+// Size the synthetic Nek5000 common blocks. Every call to the mock Nek5000
+// routines refills them with smooth values.
+void setup(int num_layers, int n_legendre, int m_fourier);
+}
+
+#endif /* MOCKNEK_H */
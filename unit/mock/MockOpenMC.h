@@ -0,0 +1,29 @@
+#ifndef MOCKOPENMC_H
+#define MOCKOPENMC_H
+
+#include <cstdint>
+#include <string>
+
+// Controls for the synthetic problem behind the mock OpenMC library. The
+// geometry has cells with IDs 1, ..., num_cells, each filled with its own
+// material of the same ID. There is a single tally with ID 1 that has a cell
+// filter over every cell and one functional expansion filter, and whose results
+// are filled with smooth, positive values.
+namespace MockOpenMC
+{
+
+void setup(int32_t num_cells,
+           const std::string & expansion_type,
+           int order,
+           bool cell_filter_first = true);
+
+// number of bins of an expansion filter of the given type and order
+int32_t expansionBins(const std::string & expansion_type, int order);
+
+// number of calls to openmc_cell_set_temperature and
+// openmc_material_set_density since setup()
+int64_t numTemperatureUpdates();
+int64_t numDensityUpdates();
+}
+
+#endif /* MOCKOPENMC_H */
@@ -0,0 +1,71 @@
+#ifndef MOCK_OPENMC_H
+#define MOCK_OPENMC_H
+
+// Stand-in for the subset of the OpenMC C API that Okapi calls, implemented in
+// MockOpenMC.C on top of a synthetic geometry and tally that can be sized from
+// the benchmarks (see MockOpenMC.h). The declarations match openmc.h, so that
+// Okapi source files can be compiled against this header unchanged.
+
+#include <cstdint>
+
+extern "C" {
+
+struct Bank
+{
+  double wgt;
+  double xyz[3];
+  double uvw[3];
+  double E;
+  int delayed_group;
+};
+
+int openmc_cell_filter_get_bins(int32_t index, int32_t ** cells, int32_t * n);
+int openmc_cell_get_id(int32_t index, int32_t * id);
+int openmc_cell_set_temperature(int32_t index, double T, const int32_t * instance);
+int openmc_filter_get_type(int32_t index, char * type);
+int openmc_finalize();
+int openmc_get_cell_index(int32_t id, int32_t * index);
+int openmc_get_keff(double k_combined[]);
+int openmc_get_material_index(int32_t id, int32_t * index);
+int openmc_get_tally_index(int32_t id, int32_t * index);
+int openmc_init(int argc, char * argv[], const void * intracomm);
+int openmc_legendre_filter_get_order(int32_t index, int * order);
+int openmc_material_set_density(int32_t index, double density);
+int openmc_next_batch(int * status);
+int openmc_reset();
+int openmc_run();
+int openmc_simulation_finalize();
+int openmc_simulation_init();
+int openmc_source_bank(Bank ** ptr, int64_t * n);
+int openmc_spatial_legendre_filter_get_order(int32_t index, int * order);
+int openmc_sphharm_filter_get_order(int32_t index, int * order);
+int openmc_tally_get_filters(int32_t index, int32_t ** indices, int32_t * n);
+int openmc_tally_results(int32_t index, double ** ptr, int shape_[3]);
+int openmc_zernike_filter_get_order(int32_t index, int * order);
+
+extern const int OPENMC_E_UNASSIGNED;
+extern const int OPENMC_E_ALLOCATE;
+extern const int OPENMC_E_OUT_OF_BOUNDS;
+extern const int OPENMC_E_INVALID_SIZE;
+extern const int OPENMC_E_INVALID_ARGUMENT;
+extern const int OPENMC_E_INVALID_TYPE;
+extern const int OPENMC_E_INVALID_ID;
+extern const int OPENMC_E_GEOMETRY;
+extern const int OPENMC_E_DATA;
+extern const int OPENMC_E_PHYSICS;
+extern const int OPENMC_E_WARNING;
+
+extern char openmc_err_msg[256];
+
+extern int32_t gen_per_batch;
+extern int32_t n_batches;
+extern int32_t n_cells;
+extern int32_t n_filters;
+extern int32_t n_inactive;
+extern int32_t n_materials;
+extern int64_t n_particles;
+extern int32_t n_realizations;
+extern int32_t n_tallies;
+}
+
+#endif /* MOCK_OPENMC_H */